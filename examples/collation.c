@@ -0,0 +1,88 @@
+// Compares sorting names by building a collation key for each one up front
+// against collating inside the `qsort` comparator.
+//
+// Usage: collation [COUNT]
+//
+// Build with `-DTWINE_COLLATION`.
+
+#include <stdio.h>
+#include <time.h>
+
+#define TWINE_IMPLEMENTATION
+#include "../twine.h"
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static twStringBuf key_a, key_b;
+
+static int compare_collated(const void *a, const void *b) {
+    key_a.length = 0;
+    key_b.length = 0;
+    twCollationKeyUTF8(&key_a, *(const twString *)a, TW_COLLATE_TERTIARY);
+    twCollationKeyUTF8(&key_b, *(const twString *)b, TW_COLLATE_TERTIARY);
+    return twCompare(twBufToString(key_a), twBufToString(key_b));
+}
+
+int main(int argc, char **argv) {
+    static const char *first[] = { "Zoë", "zoe", "Émile", "emile", "Ångström", "Søren", "Ærøskøbing", "Łukasz", "Müller", "Mueller" };
+    static const char *last[] = { "Dvořák", "dvorak", "Nuñez", "Núñez", "O'Brien", "Côté", "cote", "Smith", "Şahin", "Straße" };
+
+    size_t count = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+    twString *names = malloc(count * sizeof(*names));
+    char *text = malloc(count * 48);
+    char *at = text;
+    unsigned seed = 1;
+    size_t ascii = 0;
+    for (size_t i = 0; i < count; i++) {
+        seed = seed * 1103515245 + 12345;
+        unsigned r = seed >> 8;
+        int n = sprintf(at, "%s %s %u", first[r % 10], last[(r / 10) % 10], r % 10000);
+        names[i] = (twString){ at, n };
+        at += n;
+
+        bool is_ascii = true;
+        for (int j = 0; j < n; j++) is_ascii &= (unsigned char)names[i].bytes[j] < 0x80;
+        ascii += is_ascii;
+    }
+    printf("%zu names (%zu all ASCII)\n", count, ascii);
+
+    // Keys go into one buffer, then become strings once it has stopped moving.
+    double start = now();
+    twStringBuf buf = twNewBuf();
+    size_t *ends = malloc(count * sizeof(*ends));
+    for (size_t i = 0; i < count; i++) {
+        twCollationKeyUTF8(&buf, names[i], TW_COLLATE_TERTIARY);
+        ends[i] = buf.length;
+    }
+    double build = now() - start;
+
+    twString *keys = malloc(count * sizeof(*keys));
+    for (size_t i = 0; i < count; i++) {
+        size_t begin = i == 0 ? 0 : ends[i - 1];
+        keys[i] = (twString){ buf.bytes + begin, ends[i] - begin };
+    }
+
+    start = now();
+    twSortStrings(keys, count);
+    double sort = now() - start;
+    printf("keys:       %.3fs to build (%.0f ns each, %.1f bytes), %.3fs to sort\n",
+           build, build / count * 1e9, (double)buf.length / count, sort);
+
+    size_t ncompared = count < 100000 ? count : 100000;
+    start = now();
+    qsort(names, ncompared, sizeof(*names), compare_collated);
+    printf("comparator: %.3fs to sort %zu names\n", now() - start, ncompared);
+
+    free(keys);
+    free(ends);
+    twFreeBuf(buf);
+    twFreeBuf(key_a);
+    twFreeBuf(key_b);
+    free(text);
+    free(names);
+    return 0;
+}
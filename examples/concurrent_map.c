@@ -0,0 +1,134 @@
+// Measures `twConcurrentMap` and `twInterner` throughput from 1 to 64 threads
+// on Zipf-distributed keys, so a few hot keys take most of the traffic.
+//
+// Usage: concurrent_map [NKEYS] [ZIPF_S]
+//
+// Each thread does 90% finds and 10% inserts on the map, then interns its
+// whole key stream. Build with `-pthread -lm`.
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#define TWINE_IMPLEMENTATION
+#include "../twine.h"
+
+enum { OPS_PER_THREAD = 1 << 20 };
+
+typedef struct {
+    twString *keys;
+    double *cdf;
+    size_t nkeys;
+    twConcurrentMap *map;
+    twInterner *interner;
+    size_t hits;
+} Bench;
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint64_t next_random(uint64_t *state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+static size_t zipf_index(const Bench *b, uint64_t *state) {
+    double u = (next_random(state) >> 11) * (1.0 / 9007199254740992.0);
+    size_t lo = 0, hi = b->nkeys - 1;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (b->cdf[mid] < u) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+static void run_map(size_t index, size_t worker, void *data) {
+    (void)worker;
+    Bench *b = data;
+    uint64_t state = 0x9E3779B97F4A7C15ULL * (index + 1);
+    size_t hits = 0;
+
+    for (size_t i = 0; i < OPS_PER_THREAD; i++) {
+        uint64_t r = next_random(&state);
+        size_t k = zipf_index(b, &state);
+        if (r % 10 == 0) {
+            twInsertConcurrentMap(b->map, b->keys[k], (void *)(uintptr_t)(k + 1));
+        } else {
+            void *value;
+            hits += twFindConcurrentMap(b->map, b->keys[k], &value);
+        }
+    }
+
+    __atomic_fetch_add(&b->hits, hits, __ATOMIC_RELAXED);
+}
+
+static void run_interner(size_t index, size_t worker, void *data) {
+    (void)worker;
+    Bench *b = data;
+    uint64_t state = 0xD1B54A32D192ED03ULL * (index + 1);
+
+    for (size_t i = 0; i < OPS_PER_THREAD; i++) {
+        uint32_t id;
+        twIntern(b->interner, b->keys[zipf_index(b, &state)], &id);
+    }
+}
+
+int main(int argc, char **argv) {
+    Bench b = {0};
+    b.nkeys = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+    double s = argc > 2 ? strtod(argv[2], NULL) : 1.0;
+    if (b.nkeys == 0) b.nkeys = 1;
+
+    b.keys = malloc(b.nkeys * sizeof(*b.keys));
+    b.cdf = malloc(b.nkeys * sizeof(*b.cdf));
+    char *text = malloc(b.nkeys * 24);
+
+    double total = 0;
+    char *at = text;
+    for (size_t i = 0; i < b.nkeys; i++) {
+        int n = sprintf(at, "key:%zu:%zx", i, i * 2654435761u);
+        b.keys[i] = (twString){ at, n };
+        at += n;
+        total += 1.0 / pow(i + 1, s);
+        b.cdf[i] = total;
+    }
+    for (size_t i = 0; i < b.nkeys; i++) {
+        b.cdf[i] /= total;
+    }
+
+    printf("%zu keys, zipf s=%.2f, %d ops per thread\n", b.nkeys, s, OPS_PER_THREAD);
+    printf("threads   map Mops/s   intern Mops/s   interned\n");
+
+    for (size_t nthreads = 1; nthreads <= 64; nthreads *= 2) {
+        twExecutor ex = twThreadExecutor(nthreads);
+        double ops = (double)nthreads * OPS_PER_THREAD;
+
+        b.map = twNewConcurrentMap();
+        b.hits = 0;
+        double start = now();
+        twRunTasks(&ex, nthreads, run_map, &b);
+        double map = now() - start;
+        twFreeConcurrentMap(b.map);
+
+        b.interner = twNewInterner();
+        start = now();
+        twRunTasks(&ex, nthreads, run_interner, &b);
+        double intern = now() - start;
+        size_t interned = twInternerLength(b.interner);
+        twFreeInterner(b.interner);
+
+        printf("%7zu %12.1f %15.1f %10zu   (hits: %zu)\n",
+               nthreads, ops / map / 1e6, ops / intern / 1e6, interned, b.hits);
+    }
+
+    free(text);
+    free(b.cdf);
+    free(b.keys);
+    return 0;
+}
@@ -0,0 +1,55 @@
+// Compares `twHash64` against byte-at-a-time FNV-1a for keys from 1 to 1024
+// bytes long.
+
+#include <stdio.h>
+#include <time.h>
+
+#define TWINE_IMPLEMENTATION
+#include "../twine.h"
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint64_t fnv1a(twString s) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < s.length; i++) {
+        h ^= (unsigned char)s.bytes[i];
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+int main(void) {
+    enum { NKEYS = 4096 };
+    static char data[NKEYS + 1024];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (char)(i * 2654435761u >> 13);
+    }
+
+    printf("bytes   twHash64 ns   GB/s    FNV-1a ns   GB/s\n");
+    for (size_t length = 1; length <= 1024; length *= 2) {
+        size_t rounds = (64 << 20) / (length + 16);
+        uint64_t sink = 0;
+
+        double start = now();
+        for (size_t i = 0; i < rounds; i++) {
+            sink += twHash64((twString){ data + i % NKEYS, length }, 0);
+        }
+        double tw = (now() - start) / rounds;
+
+        start = now();
+        for (size_t i = 0; i < rounds; i++) {
+            sink += fnv1a((twString){ data + i % NKEYS, length });
+        }
+        double fnv = (now() - start) / rounds;
+
+        printf("%5zu %13.2f %6.2f %12.2f %6.2f   (%llx)\n",
+               length, tw * 1e9, length / tw / 1e9, fnv * 1e9, length / fnv / 1e9,
+               (unsigned long long)(sink & 0xF));
+    }
+
+    return 0;
+}
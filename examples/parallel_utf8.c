@@ -0,0 +1,79 @@
+// Measures how `twIsValidParallelUTF8` and `twLenParallelUTF8` scale from one
+// thread up to one per CPU.
+//
+// Usage: parallel_utf8 [FILE]
+//
+// Without a file, 256 MiB of mixed ASCII and multi-byte text is generated.
+// Build with `-pthread`.
+
+#include <stdio.h>
+#include <time.h>
+
+#define TWINE_IMPLEMENTATION
+#include "../twine.h"
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static twString generate(size_t length) {
+    static const char *samples[] = { "twine ", "h\xC3\xA9llo ", "\xE2\x82\xAC" "5 ", "\xF0\x9F\xA7\xB6 " };
+
+    char *bytes = malloc(length);
+    size_t i = 0;
+    for (unsigned seed = 1; i < length; ) {
+        seed = seed * 1103515245 + 12345;
+        const char *sample = samples[(seed >> 16) % 4];
+        size_t n = strlen(sample);
+        if (n > length - i) break;
+        memcpy(bytes + i, sample, n);
+        i += n;
+    }
+
+    return (twString){ bytes, i };
+}
+
+int main(int argc, char **argv) {
+    twMapping mapping = {0};
+    twString s;
+    if (argc > 1) {
+        s = twMapFile(argv[1], &mapping);
+        if (s.bytes == NULL) {
+            perror(argv[1]);
+            return 1;
+        }
+    } else {
+        s = generate((size_t)256 << 20);
+    }
+
+    long ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+    printf("%zu MiB, %ld CPUs\n", s.length >> 20, ncpus);
+    printf("threads   validate MB/s   count MB/s\n");
+
+    for (long nthreads = 1; ; nthreads *= 2) {
+        if (nthreads > ncpus) nthreads = ncpus;
+        twExecutor ex = twThreadExecutor(nthreads);
+
+        double start = now();
+        bool valid = twIsValidParallelUTF8(s, &ex);
+        double validate = now() - start;
+
+        start = now();
+        size_t length = twLenParallelUTF8(s, &ex);
+        double count = now() - start;
+
+        printf("%7ld %14.0f %12.0f   (valid: %d, codepoints: %zu)\n",
+               nthreads, s.length / 1e6 / validate, s.length / 1e6 / count, valid, length);
+
+        if (nthreads == ncpus) break;
+    }
+
+    if (argc > 1) {
+        twUnmapFile(mapping);
+    } else {
+        free((void *)s.bytes);
+    }
+    return 0;
+}
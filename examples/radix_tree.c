@@ -0,0 +1,100 @@
+// Matches request paths against routes by longest prefix, comparing a loop of
+// `twStartsWith` over every route with `twLongestPrefixRadixTree`.
+//
+// Usage: radix_tree [NROUTES]
+
+#include <stdio.h>
+#include <time.h>
+
+#define TWINE_IMPLEMENTATION
+#include "../twine.h"
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static const char *services[] = { "users", "orders", "products", "payments", "search", "admin", "static", "reports" };
+
+static int make_route(char *out, unsigned r) {
+    return sprintf(out, "/api/v%u/%s/%u/%s", r % 3 + 1, services[(r >> 2) % 8], (r >> 5) % 4096,
+                   services[(r >> 17) % 8]);
+}
+
+static bool longest_by_loop(const twString *routes, size_t n, twString path, size_t *match) {
+    bool found = false;
+    for (size_t i = 0; i < n; i++) {
+        if (twStartsWith(path, routes[i]) && (!found || routes[i].length > routes[*match].length)) {
+            *match = i;
+            found = true;
+        }
+    }
+    return found;
+}
+
+int main(int argc, char **argv) {
+    size_t nroutes = argc > 1 ? strtoul(argv[1], NULL, 10) : 50000;
+    enum { NPATHS = 1 << 16 };
+
+    twRadixTree *tree = twNewRadixTree();
+    twString *routes = malloc(nroutes * sizeof(*routes));
+    char *text = malloc(nroutes * 64 + NPATHS * 96);
+    char *at = text;
+
+    unsigned seed = 1;
+    for (size_t i = 0; i < nroutes; i++) {
+        seed = seed * 1103515245 + 12345;
+        int n = make_route(at, seed);
+        // Every fourth route stops at the resource, so shorter prefixes match too.
+        if (i % 4 == 0) n = (int)(strrchr(at, '/') - at);
+        routes[i] = (twString){ at, n };
+        twInsertRadixTree(tree, routes[i], (void *)(uintptr_t)i);
+        at += n;
+    }
+
+    twString *paths = malloc(NPATHS * sizeof(*paths));
+    for (size_t i = 0; i < NPATHS; i++) {
+        seed = seed * 1103515245 + 12345;
+        int n = make_route(at, seed);
+        n += sprintf(at + n, "/%u?page=%u", seed % 100, seed % 7);
+        paths[i] = (twString){ at, n };
+        at += n;
+    }
+
+    printf("%zu routes (%zu unique), %.1f MiB in the tree\n", nroutes, twRadixTreeLength(tree),
+           twRadixTreeMemoryUsage(tree) / 1048576.0);
+
+    size_t nloop = 1000, matched = 0, agree = 0;
+    double start = now();
+    for (size_t i = 0; i < nloop; i++) {
+        size_t match;
+        matched += longest_by_loop(routes, nroutes, paths[i], &match);
+    }
+    double loop = (now() - start) / nloop;
+
+    start = now();
+    for (size_t i = 0; i < NPATHS; i++) {
+        twString prefix;
+        matched += twLongestPrefixRadixTree(tree, paths[i], &prefix, NULL);
+    }
+    double radix = (now() - start) / NPATHS;
+
+    for (size_t i = 0; i < nloop; i++) {
+        size_t match;
+        twString prefix = {0};
+        bool by_loop = longest_by_loop(routes, nroutes, paths[i], &match);
+        bool by_tree = twLongestPrefixRadixTree(tree, paths[i], &prefix, NULL);
+        agree += by_loop == by_tree && (!by_loop || prefix.length == routes[match].length);
+    }
+
+    printf("twStartsWith loop: %10.0f ns per path\n", loop * 1e9);
+    printf("twRadixTree:       %10.0f ns per path   (%zu matched, %zu/%zu agree)\n",
+           radix * 1e9, matched, agree, nloop);
+
+    twFreeRadixTree(tree);
+    free(paths);
+    free(routes);
+    free(text);
+    return 0;
+}
@@ -0,0 +1,91 @@
+// Compares reading many files one after another with `read()` against
+// `twReadFiles`, counting the lines in each file as a stand-in for parsing.
+//
+// Usage: read_files [-j IN_FLIGHT] FILE...
+//
+// Build with `-pthread`, and with `-DTWINE_IO_URING` to try io_uring on Linux.
+// Drop the page cache between runs to measure cold reads.
+
+#include <stdio.h>
+#include <time.h>
+
+#define TWINE_IMPLEMENTATION
+#include "../twine.h"
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t count_lines(twString s) {
+    size_t lines = 0;
+    const char *p = s.bytes, *end = s.bytes + s.length;
+    while ((p = memchr(p, '\n', end - p)) != NULL) {
+        lines++;
+        p++;
+    }
+    return lines;
+}
+
+static size_t read_sequential(char **paths, int npaths) {
+    size_t lines = 0;
+    twStringBuf buf = twNewBufWithCapacity(64 * 1024);
+
+    for (int i = 0; i < npaths; i++) {
+        int fd = open(paths[i], O_RDONLY);
+        if (fd < 0) continue;
+
+        buf.length = 0;
+        for (;;) {
+            if (buf.length == buf.capacity && !twResizeBuf(&buf, buf.capacity * 2)) break;
+            ssize_t n = read(fd, buf.bytes + buf.length, buf.capacity - buf.length);
+            if (n <= 0) break;
+            buf.length += n;
+        }
+        close(fd);
+
+        lines += count_lines(twBufToString(buf));
+    }
+
+    twFreeBuf(buf);
+    return lines;
+}
+
+static bool on_file(size_t index, twString contents, int error, void *data) {
+    (void)index;
+    if (error == 0) {
+        *(size_t *)data += count_lines(contents);
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    size_t in_flight = 0;
+    int first = 1;
+    if (argc > 2 && strcmp(argv[1], "-j") == 0) {
+        in_flight = strtoul(argv[2], NULL, 10);
+        first = 3;
+    }
+    if (first >= argc) {
+        fprintf(stderr, "usage: %s [-j IN_FLIGHT] FILE...\n", argv[0]);
+        return 1;
+    }
+
+    char **paths = argv + first;
+    int npaths = argc - first;
+
+    double start = now();
+    size_t lines = read_sequential(paths, npaths);
+    printf("read():      %zu lines in %.3fs\n", lines, now() - start);
+
+    start = now();
+    lines = 0;
+    if (!twReadFiles((const char *const *)paths, npaths, in_flight, on_file, &lines)) {
+        perror("twReadFiles");
+        return 1;
+    }
+    printf("twReadFiles: %zu lines in %.3fs\n", lines, now() - start);
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+// Compares `twSortStrings` against `qsort` with a `twCompare` wrapper on
+// strings with short, long and shared prefixes, and on an organ-pipe sequence
+// that defeats median-of-three pivots.
+//
+// Usage: sort_strings [COUNT]
+
+#include <stdio.h>
+#include <time.h>
+
+#define TWINE_IMPLEMENTATION
+#include "../twine.h"
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int compare(const void *a, const void *b) {
+    return twCompare(*(const twString *)a, *(const twString *)b);
+}
+
+static twString *generate(size_t count, int kind, char *text) {
+    static const char *words[] = { "alpha", "beta", "gamma", "delta", "epsilon", "zeta", "eta", "theta" };
+
+    twString *strs = malloc(count * sizeof(*strs));
+    unsigned seed = 1;
+    for (size_t i = 0; i < count; i++) {
+        seed = seed * 1103515245 + 12345;
+        unsigned r = seed >> 8;
+
+        int n;
+        switch (kind) {
+        case 0:
+            n = sprintf(text, "%s%u", words[r % 8], r % 1000);
+            break;
+        case 1:
+            n = sprintf(text, "https://example.com/users/%u/posts/%u", r % 5000, (r >> 12) % 100);
+            break;
+        case 2:
+            n = sprintf(text, "%08x%08x", r, r * 2654435761u);
+            break;
+        default:
+            n = sprintf(text, "%08zu", i < count / 2 ? i : count - i);
+            break;
+        }
+
+        strs[i] = (twString){ text, n };
+        text += n;
+    }
+    return strs;
+}
+
+int main(int argc, char **argv) {
+    size_t count = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+    static const char *kinds[] = { "words", "urls", "hex", "organ" };
+
+    char *text = malloc(count * 64);
+    printf("%zu strings\n", count);
+    printf("kind    qsort s   twSortStrings s\n");
+
+    for (int kind = 0; kind < 4; kind++) {
+        twString *a = generate(count, kind, text);
+        twString *b = malloc(count * sizeof(*b));
+        memcpy(b, a, count * sizeof(*b));
+
+        double start = now();
+        qsort(a, count, sizeof(*a), compare);
+        double qs = now() - start;
+
+        start = now();
+        twSortStrings(b, count);
+        double tw = now() - start;
+
+        bool same = true;
+        for (size_t i = 0; i < count; i++) {
+            same &= twEqual(a[i], b[i]);
+        }
+
+        printf("%-5s %9.3f %17.3f   (%s)\n", kinds[kind], qs, tw, same ? "same order" : "DIFFERENT");
+        free(a);
+        free(b);
+    }
+
+    free(text);
+    return 0;
+}
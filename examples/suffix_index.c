@@ -0,0 +1,109 @@
+// Builds a `twSuffixIndex` over a generated log, with and without
+// `TW_SUFFIX_FM_INDEX`, and compares counting needles in it against a loop of
+// `twContains`. Also times saving the index and loading it back.
+//
+// Usage: suffix_index [MEGABYTES]
+
+#include <stdio.h>
+#include <time.h>
+
+#define TWINE_IMPLEMENTATION
+#include "../twine.h"
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static const char *levels[] = { "INFO", "WARN", "ERROR", "DEBUG" };
+static const char *events[] = { "request served", "cache miss", "retrying upstream", "session expired",
+                                "connection reset", "slow query", "user logged in", "rate limited" };
+
+static size_t count_by_loop(twString text, twString needle) {
+    size_t count = 0;
+    for (ssize_t at; (at = twContains(text, needle)) >= 0; count++) {
+        text.bytes += at + 1;
+        text.length -= at + 1;
+    }
+    return count;
+}
+
+int main(int argc, char **argv) {
+    size_t size = (argc > 1 ? strtoul(argv[1], NULL, 10) : 32) << 20;
+    enum { NNEEDLES = 1 << 14 };
+
+    char *bytes = malloc(size + 128);
+    size_t length = 0;
+    unsigned seed = 1;
+    while (length < size) {
+        seed = seed * 1103515245 + 12345;
+        unsigned r = seed >> 8;
+        length += sprintf(bytes + length, "%02u:%02u:%02u %s user=%u %s\n", r % 24, (r >> 5) % 60, (r >> 11) % 60,
+                          levels[(r >> 3) % 4], (r >> 9) % 50000, events[(r >> 17) % 8]);
+    }
+    twString text = { bytes, length };
+
+    // Needles are pieces of the text, so most of them occur.
+    twString *needles = malloc(NNEEDLES * sizeof(*needles));
+    for (size_t i = 0; i < NNEEDLES; i++) {
+        seed = seed * 1103515245 + 12345;
+        size_t n = 4 + seed % 20;
+        needles[i] = (twString){ bytes + (seed >> 4) % (length - n), n };
+    }
+
+    size_t nloop = 16, total = 0;
+    double start = now();
+    for (size_t i = 0; i < nloop; i++) {
+        total += count_by_loop(text, needles[i]);
+    }
+    double loop = (now() - start) / nloop;
+    printf("%.1f MiB of text\n", length / 1048576.0);
+    printf("twContains loop: %12.0f ns per needle\n", loop * 1e9);
+
+    static const char *names[] = { "suffix array", "FM-index" };
+    for (int fm = 0; fm < 2; fm++) {
+        start = now();
+        twSuffixIndex *idx = twNewSuffixIndex(text, fm ? TW_SUFFIX_FM_INDEX : 0);
+        double build = now() - start;
+
+        size_t agree = 0;
+        for (size_t i = 0; i < nloop; i++) {
+            agree += twCountSuffixIndex(idx, needles[i]) == count_by_loop(text, needles[i]);
+        }
+
+        start = now();
+        size_t matches = 0;
+        for (size_t i = 0; i < NNEEDLES; i++) {
+            matches += twCountSuffixIndex(idx, needles[i]);
+        }
+        double count = (now() - start) / NNEEDLES;
+
+        start = now();
+        for (size_t i = 0; i < NNEEDLES; i++) {
+            matches += twFindSuffixIndex(idx, needles[i]) >= 0;
+        }
+        double find = (now() - start) / NNEEDLES;
+
+        start = now();
+        twSaveSuffixIndex(idx, "suffix_index.bin");
+        double save = now() - start;
+        start = now();
+        twSuffixIndex *loaded = twLoadSuffixIndex("suffix_index.bin", text);
+        double load = now() - start;
+        remove("suffix_index.bin");
+
+        printf("\n%s: %.2fs to build, %.2f bytes per byte of text\n", names[fm], build,
+               (double)twSuffixIndexMemoryUsage(idx) / length);
+        printf("  count: %8.0f ns per needle   (%zu matches, %zu/%zu agree)\n", count * 1e9, matches, agree, nloop);
+        printf("  find:  %8.0f ns per needle\n", find * 1e9);
+        printf("  save:  %8.3fs, load: %.3fs%s\n", save, load, loaded != NULL ? "" : " (FAILED)");
+
+        twFreeSuffixIndex(loaded);
+        twFreeSuffixIndex(idx);
+    }
+
+    free(needles);
+    free(bytes);
+    return 0;
+}